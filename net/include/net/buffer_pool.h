@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <net/callbacks.h>
+#include <net/timer_id.h>
+#include <unordered_set>
+#include <vector>
+
+namespace talko::net {
+class EventLoop;
+class ByteBuffer;
+
+/**
+ * @brief 缓冲区内存池
+ *
+ * 每个事件循环持有一个内存池，按 4K/16K/64K 三种规格缓存固定大小的内存块，
+ * 供该事件循环上的 ByteBuffer 及输出队列复用。仅在创建者线程中访问空闲链表，
+ * 其它线程申请或归还内存时直接向系统申请或释放，因此无需加锁。
+ */
+class BufferPool {
+public:
+    /**
+     * @brief Construct a new Buffer Pool object
+     *
+     * @param loop 所属的事件循环
+     */
+    explicit BufferPool(EventLoop* loop);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&)            = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    BufferPool(BufferPool&&)            = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+
+    /**
+     * @brief 申请内存块
+     *
+     * @param size 期望的大小，返回时被设置为内存块的实际大小
+     * @return char* 返回内存块的起始地址
+     */
+    char* allocate(size_t& size);
+
+    /**
+     * @brief 归还内存块
+     *
+     * @param data 内存块的起始地址
+     * @param size 内存块的实际大小
+     */
+    void deallocate(char* data, size_t size);
+
+    /** 跟踪缓冲区，空闲超时后将其存储空间归还给内存池，只能在创建者线程中调用 */
+    void track(ByteBuffer* buffer);
+
+    /** 取消跟踪缓冲区，只能在创建者线程中调用 */
+    void untrack(ByteBuffer* buffer);
+
+    /** 设置缓冲区的空闲超时时长 */
+    void setIdleTimeout(Duration timeout);
+
+    /** 获取缓冲区的空闲超时时长 */
+    Duration idleTimeout() const;
+
+    /** 获取已借出的内存大小 */
+    size_t heldBytes() const;
+
+    /** 获取已借出内存中实际存放数据的大小，在每次回收空闲缓冲区时更新 */
+    size_t usedBytes() const;
+
+    /** 获取内存池中缓存的内存大小 */
+    size_t cachedBytes() const;
+
+    /** 将请求的大小向上取整为内存块的规格 */
+    static size_t roundUp(size_t size);
+
+private:
+    /** 回收空闲的缓冲区 */
+    void reclaimIdleBuffers();
+
+    /** 获取规格对应的空闲链表索引，不属于任何规格时返回 -1 */
+    static int classIndex(size_t size);
+
+    /** 是否处于创建者线程中 */
+    bool isInCreatorThread() const;
+
+private:
+    static constexpr size_t kClassNum { 3 };                                          ///< 规格数目
+    static constexpr size_t kClassSizes[kClassNum] { 4 * 1024, 16 * 1024, 64 * 1024 }; ///< 内存块规格
+    static const size_t     kMaxCachedBytes { 1024 * 1024 };                          ///< 每种规格最多缓存的内存大小
+
+    EventLoop* loop_;      ///< 所属的事件循环
+    long       thread_id_; ///< 创建线程的编号
+
+    std::array<std::vector<char*>, kClassNum> free_lists_; ///< 各规格的空闲链表
+    std::unordered_set<ByteBuffer*>           buffers_;    ///< 被跟踪的缓冲区
+
+    Duration idle_timeout_ { 10000 }; ///< 空闲超时时长
+    TimerId  reclaim_timer_;          ///< 回收空闲缓冲区的定时器
+    bool     reclaiming_ { false };   ///< 是否已开启回收定时器
+
+    std::atomic_size_t held_bytes_ { 0 };   ///< 已借出的内存大小
+    std::atomic_size_t used_bytes_ { 0 };   ///< 已借出内存中实际存放数据的大小
+    std::atomic_size_t cached_bytes_ { 0 }; ///< 缓存的内存大小
+};
+} // namespace talko::net
@@ -2,25 +2,37 @@
 
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <net/common.h>
 #include <string>
 #include <vector>
 
 namespace talko::net {
+class BufferPool;
+
 /**
  * @brief 缓冲区
  *
+ * 存储空间可以来自于事件循环的内存池，也可以直接向系统申请。
+ * 来自内存池的缓冲区在首次写入时才申请存储空间。
  */
 class ByteBuffer {
 public:
-    using Iter      = std::vector<char>::iterator;
-    using ConstIter = std::vector<char>::const_iterator;
+    using Iter      = char*;
+    using ConstIter = const char*;
 
     ByteBuffer(size_t initial_size = kInitialSize);
-    ~ByteBuffer() = default;
 
-    ByteBuffer(const ByteBuffer&)            = default;
-    ByteBuffer& operator=(const ByteBuffer&) = default;
+    /**
+     * @brief Construct a new Byte Buffer object
+     *
+     * @param pool 提供存储空间的内存池
+     */
+    explicit ByteBuffer(std::shared_ptr<BufferPool> pool);
+    ~ByteBuffer();
+
+    ByteBuffer(const ByteBuffer& other);
+    ByteBuffer& operator=(const ByteBuffer& other);
 
     /** 交换缓冲区 */
     void swap(ByteBuffer& other);
@@ -86,7 +98,7 @@ public:
     T readBytes() {
         assert(sizeof(T) <= readableBytes());
         T res;
-        ::memcpy(&res, *reader(), sizeof(T));
+        ::memcpy(&res, reader(), sizeof(T));
         reader_idx_ += sizeof(T);
         return common::networkToHost(res);
     }
@@ -108,8 +120,9 @@ public:
             expand(sizeof(T));
         }
         T tmp = common::hostToNetwork(val);
-        ::memcpy(*writer(), &tmp, sizeof(T));
+        ::memcpy(writer(), &tmp, sizeof(T));
         writer_idx_ += sizeof(T);
+        idle_ = false;
     }
 
     /**
@@ -120,10 +133,10 @@ public:
      * @return T 返回获取到的数据
      */
     template <typename T>
-    T getBytes(size_t idx) {
-        assert(sizeof(T) + idx < writerIndex());
+    T getBytes(size_t idx) const {
+        assert(sizeof(T) + idx <= writerIndex());
         T res;
-        ::memcpy(&res, *reader(), sizeof(T));
+        ::memcpy(&res, data_ + idx, sizeof(T));
         return common::networkToHost(res);
     }
 
@@ -136,12 +149,10 @@ public:
      */
     template <typename T>
     void setBytes(size_t idx, T val) {
-        assert(idx >= writerIndex());
-        if (sizeof(T) > writableBytes()) {
-            expand(sizeof(T));
-        }
+        assert(sizeof(T) + idx <= writerIndex());
         T tmp = common::hostToNetwork(val);
-        ::memcpy(*writer(), &tmp, sizeof(T));
+        ::memcpy(data_ + idx, &tmp, sizeof(T));
+        idle_ = false;
     }
 
     /**
@@ -165,19 +176,38 @@ public:
     /** 获取写指针 */
     Iter writer();
 
+    /** 获取缓冲区容量 */
+    size_t capacity() const;
+
+    /** 获取提供存储空间的内存池 */
+    const std::shared_ptr<BufferPool>& pool() const;
+
+    /** 在没有可读数据时释放存储空间，来自内存池的存储空间将被归还 */
+    void release();
+
+    friend class BufferPool;
+
 private:
     /** 扩容确保可写区域最少有 len 个字节的空间 */
     void expand(size_t len);
 
+    /** 申请至少 size 个字节的存储空间 */
+    char* allocate(size_t& size);
+
+    /** 释放存储空间 */
+    void deallocate(char* data, size_t size);
+
 private:
     static const size_t kInitialSize { 1024 }; ///< 初始化大小
 
-    std::vector<char> buffer_; ///< 缓冲区
-
-    size_t reader_idx_ { 0 };    ///< 读索引
-    size_t writer_idx_ { 0 };    ///< 写索引
-    size_t reader_mark_ { 0 };   ///< 读指针标记位置
-    size_t writer_mark_ { 0 };   ///< 写指针标记位置
-    size_t expand_factor_ { 2 }; ///< 扩容因子
+    std::shared_ptr<BufferPool> pool_;                ///< 提供存储空间的内存池
+    char*                       data_ { nullptr };    ///< 缓冲区
+    size_t                      capacity_ { 0 };      ///< 缓冲区容量
+    size_t                      reader_idx_ { 0 };    ///< 读索引
+    size_t                      writer_idx_ { 0 };    ///< 写索引
+    size_t                      reader_mark_ { 0 };   ///< 读指针标记位置
+    size_t                      writer_mark_ { 0 };   ///< 写指针标记位置
+    size_t                      expand_factor_ { 2 }; ///< 扩容因子
+    bool                        idle_ { false };      ///< 自上次回收检查以来是否未被写入数据
 };
 } // namespace talko::net
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace talko::net {
 class TcpConnection;
@@ -11,6 +12,7 @@ class ByteBuffer;
 using TimePoint = std::chrono::high_resolution_clock::time_point;
 using Duration  = std::chrono::duration<int, std::milli>;
 
+using BufferPtr             = std::shared_ptr<const std::string>;
 using TimerCallback         = std::function<void()>;
 using TcpConnectionPtr      = std::shared_ptr<TcpConnection>;
 using ConnectionCallback    = std::function<void(const TcpConnectionPtr&)>;
@@ -143,6 +143,16 @@ ssize_t read(int sockfd, void* buf, size_t count);
  */
 ssize_t readv(int sockfd, const iovec* iov, int iovcnt);
 
+/**
+ * @brief 聚集写入数据到套接字中
+ *
+ * @param sockfd 套接字描述符
+ * @param iov 多缓冲区结构体
+ * @param iovcnt 缓冲区数目
+ * @return ssize_t 返回实际写入的字节数
+ */
+ssize_t writev(int sockfd, const iovec* iov, int iovcnt);
+
 /** 是否为自连接 */
 bool isSelfConnection(int sockfd);
 
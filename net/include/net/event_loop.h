@@ -12,6 +12,7 @@ namespace talko::net {
 class EpollPoller;
 class Channel;
 class TimerQueue;
+class BufferPool;
 
 /**
  * @brief 事件循环
@@ -72,6 +73,9 @@ public:
     /** 是否拥有指定通道 */
     bool hasChannel(Channel* channel) const;
 
+    /** 获取缓冲区内存池 */
+    const std::shared_ptr<BufferPool>& bufferPool() const;
+
     /** 是否正在处理事件 */
     bool isHandlingEvent() const;
 
@@ -103,6 +107,7 @@ private:
     std::unique_ptr<EpollPoller> poller_;         ///< I/O复用模型
     std::unique_ptr<Channel>     wakeup_channel_; ///< 唤醒通道
     std::unique_ptr<TimerQueue>  timer_queue_;    ///< 定时器序列
+    std::shared_ptr<BufferPool>  buffer_pool_;    ///< 缓冲区内存池
     std::mutex                   mtx_;            ///< 保护待处理事件队列的线程安全
 
     ChannelList active_channels_;                ///< 活动事件列表
@@ -7,6 +7,7 @@
 #include <pool/thread_pool.h>
 
 /** Net */
+#include <net/buffer_pool.h>
 #include <net/event_loop.h>
 #include <net/inet_address.h>
 #include <net/tcp_connection.h>
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+
+namespace talko::net {
+class BufferPool;
+
+/**
+ * @brief 输出队列
+ *
+ * 由若干引用计数的数据片段组成，写出时通过 writev 将多个片段一次性写入套接字。
+ * 较小的数据会被合并拷贝到队尾的数据块中，较大的数据则直接持有其所有权而不进行拷贝。
+ */
+class OutputQueue {
+public:
+    /**
+     * @brief Construct a new Output Queue object
+     *
+     * @param pool 提供拷贝块存储空间的内存池，为空时直接向系统申请
+     */
+    explicit OutputQueue(std::shared_ptr<BufferPool> pool = nullptr);
+    ~OutputQueue() = default;
+
+    OutputQueue(const OutputQueue&)            = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    /** 拷贝并追加数据 */
+    void append(std::string_view data);
+
+    /**
+     * @brief 追加数据并接管其所有权
+     *
+     * @param data 要追加的数据
+     * @param offset 数据中已经写出的字节数
+     */
+    void append(std::string&& data, size_t offset = 0);
+
+    /**
+     * @brief 追加共享数据片段，数据的生命周期由 owner 保证
+     *
+     * @param data 要追加的数据
+     * @param owner 数据的所有者
+     */
+    void append(std::string_view data, std::shared_ptr<const void> owner);
+
+    /**
+     * @brief 将队列中的数据写入到文件描述符中
+     *
+     * @param fd 要写入的文件描述符
+     * @param saved_errno 错误码
+     * @return ssize_t 返回实际写入的数据大小
+     */
+    ssize_t writeToFd(int fd, int* saved_errno);
+
+    /** 获取待写出的数据大小 */
+    size_t readableBytes() const;
+
+    /** 是否具有待写出的数据 */
+    bool isReadable() const;
+
+    /** 清空队列 */
+    void clear();
+
+    /** 小于该大小的数据将被拷贝合并 */
+    static const size_t kCopyThreshold { 1024 };
+
+private:
+    /** 数据片段 */
+    struct Slice {
+        std::shared_ptr<const void> owner; ///< 数据的所有者
+        const char*                 data;  ///< 数据起始位置
+        size_t                      len;   ///< 数据长度
+        size_t                      spare; ///< 数据块尾部的剩余空间，仅对拷贝块有效
+    };
+
+    /** 丢弃已经写出的 bytes 个字节 */
+    void consume(size_t bytes);
+
+    /** 申请至少 size 个字节的拷贝块，返回时 size 被设置为拷贝块的实际大小 */
+    std::shared_ptr<char> allocateChunk(size_t& size);
+
+private:
+    static const size_t kChunkSize { 4096 }; ///< 拷贝块的大小
+    static const int    kMaxIovecs { 64 };   ///< 单次写出的最大片段数目
+
+    std::shared_ptr<BufferPool> pool_;        ///< 提供拷贝块存储空间的内存池
+    std::deque<Slice>           slices_;      ///< 数据片段
+    size_t                      bytes_ { 0 }; ///< 待写出的数据大小
+};
+} // namespace talko::net
@@ -6,6 +6,7 @@
 #include <net/byte_buffer.h>
 #include <net/callbacks.h>
 #include <net/inet_address.h>
+#include <net/output_queue.h>
 #include <string>
 
 namespace talko::net {
@@ -47,7 +48,13 @@ public:
     /** 向对端发送消息 */
     void send(const std::string& message);
 
-    /** 将缓冲区中的可读数据发送给对端 */
+    /** 向对端发送消息，接管消息的所有权以避免拷贝 */
+    void send(std::string&& message);
+
+    /** 向对端发送共享消息，适用于将同一份数据发送给多个连接 */
+    void send(const BufferPtr& message);
+
+    /** 将缓冲区中的可读数据发送给对端，较大的数据将直接接管缓冲区的存储空间 */
     void send(ByteBuffer* buffer);
 
     /** 是否已建立连接 */
@@ -89,8 +96,8 @@ public:
     /** 获取输入缓冲区 */
     ByteBuffer* inputBuffer();
 
-    /** 获取输出缓冲区 */
-    ByteBuffer* outputBuffer();
+    /** 获取输出队列中待发送的数据大小 */
+    size_t pendingOutputBytes() const;
 
     /** 当TcpServer接收一个新的连接时调用 */
     void connectionEstablished();
@@ -125,8 +132,23 @@ private:
     /** 处理连接上的错误事件 */
     void handleError();
 
-    /** 向对端发送消息 */
-    void send_(const std::string& message);
+    /** 向对端发送消息，未能立即写出的数据将被拷贝到输出队列中 */
+    void send_(std::string_view message);
+
+    /** 向对端发送消息，未能立即写出的数据将被移动到输出队列中 */
+    void sendString_(std::string& message);
+
+    /** 向对端发送共享数据，未能立即写出的数据将以引用的形式加入到输出队列中 */
+    void sendShared_(std::string_view message, const std::shared_ptr<const void>& owner);
+
+    /**
+     * @brief 在输出队列为空时尝试直接写入数据，并为剩余数据的入队做准备
+     *
+     * @param message 要发送的消息
+     * @param nwrote 已经写入的字节数
+     * @return 是否还有剩余数据需要加入到输出队列中
+     */
+    bool prepareSend_(std::string_view message, size_t& nwrote);
 
     /** 关闭连接 */
     void shutdown_();
@@ -164,8 +186,8 @@ private:
     HighWaterMarkCallback high_water_mark_cb_ {}; ///< 高水位标记回调函数
     CloseCallback         close_cb_ {};           ///< 关闭回调函数
 
-    ByteBuffer input_buffer_;  ///< 输入缓冲区
-    ByteBuffer output_buffer_; ///< 输出缓冲区
+    ByteBuffer  input_buffer_; ///< 输入缓冲区
+    OutputQueue output_queue_; ///< 输出队列
 
     std::any context_; ///< 上下文，用于携带额外数据
 };
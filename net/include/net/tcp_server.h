@@ -58,6 +58,9 @@ public:
     /** 设置写操作完成回调函数 */
     void setWriteCompleteCallback(WriteCompleteCallback cb);
 
+    /** 设置连接缓冲区的空闲超时时长，超时后缓冲区的存储空间将归还给事件循环的内存池 */
+    void setBufferIdleTimeout(Duration timeout);
+
 private:
     /**
      * @brief 处理新的客户端连接
@@ -102,5 +105,7 @@ private:
     size_t next_ { 0 };          ///< 下一个子事件循环的编号
     size_t sub_loop_size_ { 3 }; ///< 子事件循环数目
     size_t nxt_conn_id_ { 1 };   ///< 连接编号
+
+    Duration buffer_idle_timeout_ { 10000 }; ///< 连接缓冲区的空闲超时时长
 };
 } // namespace talko::net
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <log/log.h>
+#include <net/buffer_pool.h>
+#include <net/byte_buffer.h>
+#include <net/event_loop.h>
+#include <utils/os.h>
+
+namespace talko::net {
+BufferPool::BufferPool(EventLoop* loop)
+    : loop_(loop)
+    , thread_id_(utils::os::threadId()) {
+}
+
+BufferPool::~BufferPool() {
+    assert(buffers_.empty());
+    for (auto& free_list : free_lists_) {
+        for (char* chunk : free_list) {
+            delete[] chunk;
+        }
+    }
+}
+
+char* BufferPool::allocate(size_t& size) {
+    size = roundUp(size);
+
+    int idx = classIndex(size);
+    held_bytes_.fetch_add(size, std::memory_order_relaxed);
+    // 只有创建者线程才能访问空闲链表
+    if (idx >= 0 && isInCreatorThread() && !free_lists_[idx].empty()) {
+        char* chunk = free_lists_[idx].back();
+        free_lists_[idx].pop_back();
+        cached_bytes_.fetch_sub(size, std::memory_order_relaxed);
+        return chunk;
+    }
+    return new char[size];
+}
+
+void BufferPool::deallocate(char* data, size_t size) {
+    if (data == nullptr) return;
+
+    int idx = classIndex(size);
+    held_bytes_.fetch_sub(size, std::memory_order_relaxed);
+    // 缓存的内存达到上限或者在其它线程中归还时 直接释放内存块
+    if (idx >= 0 && isInCreatorThread() && (free_lists_[idx].size() + 1) * size <= kMaxCachedBytes) {
+        free_lists_[idx].push_back(data);
+        cached_bytes_.fetch_add(size, std::memory_order_relaxed);
+    } else {
+        delete[] data;
+    }
+}
+
+void BufferPool::track(ByteBuffer* buffer) {
+    loop_->checkIsInCreatorThread();
+    buffers_.insert(buffer);
+
+    // 在第一次跟踪缓冲区时开启回收定时器
+    if (!reclaiming_) {
+        reclaiming_    = true;
+        reclaim_timer_ = loop_->runEvery(idle_timeout_, std::bind(&BufferPool::reclaimIdleBuffers, this));
+    }
+}
+
+void BufferPool::untrack(ByteBuffer* buffer) {
+    loop_->checkIsInCreatorThread();
+    buffers_.erase(buffer);
+}
+
+void BufferPool::setIdleTimeout(Duration timeout) {
+    idle_timeout_ = timeout;
+    if (reclaiming_) {
+        loop_->cancel(reclaim_timer_);
+        reclaim_timer_ = loop_->runEvery(idle_timeout_, std::bind(&BufferPool::reclaimIdleBuffers, this));
+    }
+}
+
+Duration BufferPool::idleTimeout() const {
+    return idle_timeout_;
+}
+
+size_t BufferPool::heldBytes() const {
+    return held_bytes_.load(std::memory_order_relaxed);
+}
+
+size_t BufferPool::usedBytes() const {
+    return used_bytes_.load(std::memory_order_relaxed);
+}
+
+size_t BufferPool::cachedBytes() const {
+    return cached_bytes_.load(std::memory_order_relaxed);
+}
+
+size_t BufferPool::roundUp(size_t size) {
+    for (size_t class_size : kClassSizes) {
+        if (size <= class_size) {
+            return class_size;
+        }
+    }
+    // 超过最大规格的内存块按照最大规格的整数倍分配
+    const size_t max_size = kClassSizes[kClassNum - 1];
+    return (size + max_size - 1) / max_size * max_size;
+}
+
+void BufferPool::reclaimIdleBuffers() {
+    size_t used     = 0;
+    size_t released = 0;
+    for (ByteBuffer* buffer : buffers_) {
+        used += buffer->readableBytes();
+        // 在整个超时周期内既没有写入数据也没有待读取数据的缓冲区将归还存储空间
+        if (buffer->idle_ && !buffer->isReadable() && buffer->capacity_ > 0) {
+            released += buffer->capacity_;
+            buffer->release();
+        }
+        buffer->idle_ = true;
+    }
+    used_bytes_.store(used, std::memory_order_relaxed);
+
+    if (released > 0) {
+        LOGGER_TRACE("net", "BufferPool[{}] reclaim {} bytes from idle buffers", fmt::ptr(this), released);
+    }
+}
+
+int BufferPool::classIndex(size_t size) {
+    for (size_t i = 0; i < kClassNum; ++i) {
+        if (size == kClassSizes[i]) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool BufferPool::isInCreatorThread() const {
+    return thread_id_ == utils::os::threadId();
+}
+} // namespace talko::net
@@ -1,16 +1,50 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <net/buffer_pool.h>
 #include <net/byte_buffer.h>
 #include <string_view>
 
 namespace talko::net {
-ByteBuffer::ByteBuffer(size_t initial_size)
-    : buffer_(initial_size) {
+ByteBuffer::ByteBuffer(size_t initial_size) {
+    capacity_ = initial_size;
+    data_     = allocate(capacity_);
+}
+
+ByteBuffer::ByteBuffer(std::shared_ptr<BufferPool> pool)
+    : pool_(std::move(pool)) {
+}
+
+ByteBuffer::~ByteBuffer() {
+    deallocate(data_, capacity_);
+}
+
+ByteBuffer::ByteBuffer(const ByteBuffer& other)
+    : pool_(other.pool_)
+    , expand_factor_(other.expand_factor_) {
+    *this = other;
+}
+
+ByteBuffer& ByteBuffer::operator=(const ByteBuffer& other) {
+    if (this != &other) {
+        // 只拷贝可读区域的数据
+        skipAllBytes();
+        if (other.isReadable()) {
+            expand(other.readableBytes());
+            ::memcpy(writerPtr(), other.readerPtr(), other.readableBytes());
+        }
+        reader_idx_  = 0;
+        writer_idx_  = other.readableBytes();
+        reader_mark_ = other.reader_mark_ > other.reader_idx_ ? other.reader_mark_ - other.reader_idx_ : 0;
+        writer_mark_ = other.writer_mark_ > other.reader_idx_ ? other.writer_mark_ - other.reader_idx_ : 0;
+    }
+    return *this;
 }
 
 void ByteBuffer::swap(ByteBuffer& other) {
-    buffer_.swap(other.buffer_);
+    std::swap(pool_, other.pool_);
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
     std::swap(reader_idx_, other.reader_idx_);
     std::swap(writer_idx_, other.writer_idx_);
     std::swap(reader_mark_, other.reader_mark_);
@@ -18,19 +52,19 @@ void ByteBuffer::swap(ByteBuffer& other) {
 }
 
 const char* ByteBuffer::readerPtr() const {
-    return &*buffer_.begin() + reader_idx_;
+    return data_ + reader_idx_;
 }
 
 char* ByteBuffer::readerPtr() {
-    return &*buffer_.begin() + reader_idx_;
+    return data_ + reader_idx_;
 }
 
 const char* ByteBuffer::writerPtr() const {
-    return &*buffer_.begin() + writer_idx_;
+    return data_ + writer_idx_;
 }
 
 char* ByteBuffer::writerPtr() {
-    return &*buffer_.begin() + writer_idx_;
+    return data_ + writer_idx_;
 }
 
 void ByteBuffer::markReaderIndex() {
@@ -46,7 +80,7 @@ size_t ByteBuffer::readableBytes() const {
 }
 
 size_t ByteBuffer::writableBytes() const {
-    return buffer_.size() - writer_idx_;
+    return capacity_ - writer_idx_;
 }
 
 void ByteBuffer::resetReaderIndex() {
@@ -79,26 +113,17 @@ void ByteBuffer::skipAllBytes() {
 }
 
 void ByteBuffer::readBytes(std::vector<char>& dst) {
-    if (dst.size() < readableBytes()) {
-        dst.resize(readableBytes());
-    }
-    std::copy(buffer_.begin(), reader(), dst.begin());
+    dst.assign(reader(), writer());
     reader_idx_ = writer_idx_;
 }
 
 void ByteBuffer::readBytes(std::string& dst) {
-    if (dst.size() < readableBytes()) {
-        dst.resize(readableBytes());
-    }
-    std::copy(reader(), writer(), dst.begin());
+    dst.assign(reader(), writer());
     reader_idx_ = writer_idx_;
 }
 
 void ByteBuffer::writeBytes(const std::vector<char>& src) {
-    if (writableBytes() < src.size()) {
-        expand(src.size());
-    }
-    std::copy(src.begin(), src.end(), writer());
+    writeBytes(std::string_view(src.data(), src.size()));
 }
 
 void ByteBuffer::writeBytes(std::string_view src) {
@@ -106,12 +131,20 @@ void ByteBuffer::writeBytes(std::string_view src) {
         expand(src.size());
     }
     std::copy(src.begin(), src.end(), writer());
+    writer_idx_ += src.size();
+    idle_ = false;
 }
 
 ssize_t ByteBuffer::recvFromFd(int fd, int* saved_errno) {
     std::array<char, 65535> extra_buf;
     std::array<iovec, 2>    vec;
 
+    // 来自内存池的缓冲区在首次读取时申请存储空间
+    if (data_ == nullptr) {
+        expand(kInitialSize);
+    }
+    idle_ = false;
+
     const size_t writable = writableBytes();
 
     // 设置多个缓冲区
@@ -127,7 +160,7 @@ ssize_t ByteBuffer::recvFromFd(int fd, int* saved_errno) {
     } else if (n <= static_cast<ssize_t>(writable)) {
         writer_idx_ += n;
     } else {
-        writer_idx_ = buffer_.size();
+        writer_idx_ = capacity_;
         expand(extra_buf.size());
         std::copy(extra_buf.begin(), extra_buf.end(), writer());
     }
@@ -135,37 +168,79 @@ ssize_t ByteBuffer::recvFromFd(int fd, int* saved_errno) {
 }
 
 ByteBuffer::ConstIter ByteBuffer::reader() const {
-    return buffer_.cbegin() + reader_idx_;
+    return data_ + reader_idx_;
 }
 
 ByteBuffer::Iter ByteBuffer::reader() {
-    return buffer_.begin() + reader_idx_;
+    return data_ + reader_idx_;
 }
 
 ByteBuffer::ConstIter ByteBuffer::writer() const {
-    return buffer_.cbegin() + writer_idx_;
+    return data_ + writer_idx_;
 }
 
 ByteBuffer::Iter ByteBuffer::writer() {
-    return buffer_.begin() + writer_idx_;
+    return data_ + writer_idx_;
+}
+
+size_t ByteBuffer::capacity() const {
+    return capacity_;
+}
+
+const std::shared_ptr<BufferPool>& ByteBuffer::pool() const {
+    return pool_;
+}
+
+void ByteBuffer::release() {
+    if (isReadable()) return;
+
+    deallocate(data_, capacity_);
+    data_        = nullptr;
+    capacity_    = 0;
+    reader_idx_  = 0;
+    writer_idx_  = 0;
+    reader_mark_ = 0;
+    writer_mark_ = 0;
 }
 
 void ByteBuffer::expand(size_t len) {
     // 先用可读区域填充无效区域
     if (reader_idx_ != 0) {
-        size_t len = readableBytes();
-        std::copy(reader(), writer(), buffer_.begin());
+        size_t readable = readableBytes();
+        ::memmove(data_, readerPtr(), readable);
         reader_idx_ = 0;
-        writer_idx_ = len;
+        writer_idx_ = readable;
     }
 
     // 如果此时可写区域空间仍然不够则扩容
     if (writableBytes() < len) {
-        size_t expand_size = buffer_.size() * expand_factor_;
+        size_t expand_size = capacity_ > 0 ? capacity_ * expand_factor_ : kInitialSize;
         while (expand_size - writer_idx_ < len) {
             expand_size *= expand_factor_;
         }
-        buffer_.resize(expand_size);
+
+        char* data = allocate(expand_size);
+        if (writer_idx_ > 0) {
+            ::memcpy(data, data_, writer_idx_);
+        }
+        deallocate(data_, capacity_);
+        data_     = data;
+        capacity_ = expand_size;
+    }
+}
+
+char* ByteBuffer::allocate(size_t& size) {
+    if (pool_) {
+        return pool_->allocate(size);
+    }
+    return new char[size];
+}
+
+void ByteBuffer::deallocate(char* data, size_t size) {
+    if (pool_) {
+        pool_->deallocate(data, size);
+    } else {
+        delete[] data;
     }
 }
-} // namespace talko::net
\ No newline at end of file
+} // namespace talko::net
@@ -189,6 +189,10 @@ ssize_t readv(int sockfd, const iovec* iov, int iovcnt) {
     return ::readv(sockfd, iov, iovcnt);
 }
 
+ssize_t writev(int sockfd, const iovec* iov, int iovcnt) {
+    return ::writev(sockfd, iov, iovcnt);
+}
+
 bool isSelfConnection(int sockfd) {
     sockaddr_in local_addr = getLocalAddr(sockfd);
     sockaddr_in peer_addr  = getPeerAddr(sockfd);
@@ -1,4 +1,5 @@
 #include <log/log.h>
+#include <net/buffer_pool.h>
 #include <net/channel.h>
 #include <net/common.h>
 #include <net/epoll_poller.h>
@@ -11,7 +12,8 @@ EventLoop::EventLoop()
     , thread_id_(utils::os::threadId())
     , wakeup_fd_(common::createEventFd())
     , wakeup_channel_(std::make_unique<Channel>(this, wakeup_fd_))
-    , timer_queue_(std::make_unique<TimerQueue>(this)) {
+    , timer_queue_(std::make_unique<TimerQueue>(this))
+    , buffer_pool_(std::make_shared<BufferPool>(this)) {
     LOGGER_DEBUG("net", "Create EventLoop[{}]", fmt::ptr(this));
     // 让唤醒事件描述符监听可读事件
     wakeup_channel_->setReadCallback(std::bind(&EventLoop::handleReadToWakeUp, this));
@@ -134,6 +136,10 @@ bool EventLoop::hasChannel(Channel* channel) const {
     return poller_->hasChannel(channel);
 }
 
+const std::shared_ptr<BufferPool>& EventLoop::bufferPool() const {
+    return buffer_pool_;
+}
+
 bool EventLoop::isHandlingEvent() const {
     return handling_events_;
 }
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <net/buffer_pool.h>
+#include <net/common.h>
+#include <net/output_queue.h>
+#include <sys/uio.h>
+
+namespace talko::net {
+OutputQueue::OutputQueue(std::shared_ptr<BufferPool> pool)
+    : pool_(std::move(pool)) {
+}
+
+void OutputQueue::append(std::string_view data) {
+    if (data.empty()) return;
+    bytes_ += data.size();
+
+    // 优先填充队尾拷贝块的剩余空间
+    if (!slices_.empty() && slices_.back().spare > 0) {
+        Slice& tail = slices_.back();
+        size_t n    = std::min(tail.spare, data.size());
+        ::memcpy(const_cast<char*>(tail.data) + tail.len, data.data(), n);
+        tail.len += n;
+        tail.spare -= n;
+        data.remove_prefix(n);
+    }
+
+    if (!data.empty()) {
+        size_t                chunk_size = data.size() > kChunkSize ? data.size() : kChunkSize;
+        std::shared_ptr<char> chunk      = allocateChunk(chunk_size);
+        ::memcpy(chunk.get(), data.data(), data.size());
+        slices_.push_back({ chunk, chunk.get(), data.size(), chunk_size - data.size() });
+    }
+}
+
+void OutputQueue::append(std::string&& data, size_t offset) {
+    assert(offset <= data.size());
+    if (data.size() - offset < kCopyThreshold) {
+        append(std::string_view(data).substr(offset));
+    } else {
+        auto owner = std::make_shared<const std::string>(std::move(data));
+        append(std::string_view(*owner).substr(offset), owner);
+    }
+}
+
+void OutputQueue::append(std::string_view data, std::shared_ptr<const void> owner) {
+    if (data.empty()) return;
+    if (data.size() < kCopyThreshold) {
+        append(data);
+    } else {
+        bytes_ += data.size();
+        slices_.push_back({ std::move(owner), data.data(), data.size(), 0 });
+    }
+}
+
+ssize_t OutputQueue::writeToFd(int fd, int* saved_errno) {
+    std::array<iovec, kMaxIovecs> vec;
+
+    int iovcnt = 0;
+    for (auto iter = slices_.begin(); iter != slices_.end() && iovcnt < kMaxIovecs; ++iter) {
+        vec[iovcnt].iov_base = const_cast<char*>(iter->data);
+        vec[iovcnt].iov_len  = iter->len;
+        ++iovcnt;
+    }
+
+    const ssize_t n = common::writev(fd, vec.data(), iovcnt);
+    if (n < 0) {
+        *saved_errno = errno;
+    } else {
+        consume(static_cast<size_t>(n));
+    }
+    return n;
+}
+
+size_t OutputQueue::readableBytes() const {
+    return bytes_;
+}
+
+bool OutputQueue::isReadable() const {
+    return bytes_ > 0;
+}
+
+void OutputQueue::clear() {
+    slices_.clear();
+    bytes_ = 0;
+}
+
+void OutputQueue::consume(size_t bytes) {
+    assert(bytes <= bytes_);
+    bytes_ -= bytes;
+    while (bytes > 0) {
+        Slice& head = slices_.front();
+        if (bytes < head.len) {
+            head.data += bytes;
+            head.len -= bytes;
+            break;
+        }
+        bytes -= head.len;
+        slices_.pop_front();
+    }
+}
+
+std::shared_ptr<char> OutputQueue::allocateChunk(size_t& size) {
+    if (!pool_) {
+        return std::shared_ptr<char>(new char[size], std::default_delete<char[]>());
+    }
+    // 拷贝块在数据写出后归还给内存池
+    char* data = pool_->allocate(size);
+    return std::shared_ptr<char>(data, [pool = pool_, size](char* ptr) { pool->deallocate(ptr, size); });
+}
+} // namespace talko::net
@@ -1,4 +1,5 @@
 #include <log/log.h>
+#include <net/buffer_pool.h>
 #include <net/channel.h>
 #include <net/common.h>
 #include <net/event_loop.h>
@@ -14,7 +15,9 @@ TcpConnection::TcpConnection(EventLoop* loop, const std::string& name, int sockf
     , channel_(std::make_unique<Channel>(loop, sockfd))
     , local_addr_(local_addr)
     , peer_addr_(peer_addr)
-    , high_water_mark_(64 * 1024 * 1024) {
+    , high_water_mark_(64 * 1024 * 1024)
+    , input_buffer_(loop->bufferPool())
+    , output_queue_(loop->bufferPool()) {
     // 设置连接上相应的回调函数
     channel_->setReadCallback(std::bind(&TcpConnection::handleRead, this, std::placeholders::_1));
     channel_->setWriteCallback(std::bind(&TcpConnection::handleWrite, this));
@@ -52,20 +55,50 @@ void TcpConnection::send(const std::string& message) {
         if (loop_->isInCreatorThread()) {
             send_(message);
         } else {
-            loop_->runInLoop(std::bind(&TcpConnection::send_, this, message));
+            send(std::make_shared<const std::string>(message));
+        }
+    }
+}
+
+void TcpConnection::send(std::string&& message) {
+    if (state_ == State::Connected) {
+        if (loop_->isInCreatorThread()) {
+            sendString_(message);
+        } else {
+            send(std::make_shared<const std::string>(std::move(message)));
+        }
+    }
+}
+
+void TcpConnection::send(const BufferPtr& message) {
+    if (state_ == State::Connected) {
+        if (loop_->isInCreatorThread()) {
+            sendShared_(*message, message);
+        } else {
+            loop_->runInLoop(std::bind(&TcpConnection::sendShared_, shared_from_this(),
+                std::string_view(*message), std::shared_ptr<const void>(message)));
         }
     }
 }
 
 void TcpConnection::send(ByteBuffer* buffer) {
     if (state_ == State::Connected) {
-        std::string message;
-        buffer->readBytes(message);
+        if (loop_->isInCreatorThread() && buffer->readableBytes() < OutputQueue::kCopyThreshold) {
+            send_(std::string_view(buffer->readerPtr(), buffer->readableBytes()));
+            buffer->skipAllBytes();
+            return;
+        }
+
+        // 接管缓冲区的存储空间 调用方将得到一个新的空缓冲区
+        auto owner = buffer->pool() ? std::make_shared<ByteBuffer>(buffer->pool()) : std::make_shared<ByteBuffer>();
+        owner->swap(*buffer);
+        std::string_view message(owner->readerPtr(), owner->readableBytes());
 
         if (loop_->isInCreatorThread()) {
-            send_(message);
+            sendShared_(message, owner);
         } else {
-            loop_->runInLoop(std::bind(&TcpConnection::send_, this, message));
+            loop_->runInLoop(std::bind(&TcpConnection::sendShared_, shared_from_this(),
+                message, std::shared_ptr<const void>(owner)));
         }
     }
 }
@@ -129,8 +162,8 @@ ByteBuffer* TcpConnection::inputBuffer() {
     return &input_buffer_;
 }
 
-ByteBuffer* TcpConnection::outputBuffer() {
-    return &output_buffer_;
+size_t TcpConnection::pendingOutputBytes() const {
+    return output_queue_.readableBytes();
 }
 
 void TcpConnection::connectionEstablished() {
@@ -139,6 +172,7 @@ void TcpConnection::connectionEstablished() {
     state_ = State::Connected;
     channel_->ensureAlive(shared_from_this());
     channel_->enableReading();
+    loop_->bufferPool()->track(&input_buffer_);
 
     connection_cb_(shared_from_this());
 }
@@ -152,6 +186,7 @@ void TcpConnection::connectionDestoryed() {
         connection_cb_(shared_from_this());
     }
     channel_->remove();
+    loop_->bufferPool()->untrack(&input_buffer_);
 }
 
 void TcpConnection::setContext(const std::any& context) {
@@ -181,13 +216,11 @@ void TcpConnection::handleRead(TimePoint receive_time) {
 void TcpConnection::handleWrite() {
     loop_->checkIsInCreatorThread();
     if (channel_->isWriting()) {
-        ssize_t n = common::write(channel_->fd(), output_buffer_.writerPtr(), output_buffer_.readableBytes());
-
-        int saved_errno = errno;
+        int     saved_errno = 0;
+        ssize_t n           = output_queue_.writeToFd(channel_->fd(), &saved_errno);
 
         if (n > 0) { // 写入成功
-            output_buffer_.skipBytes(n);
-            if (!output_buffer_.isReadable()) {
+            if (!output_queue_.isReadable()) {
                 // 如果输出缓冲区的数据写入完成 则关闭写事件 并执行写操作完成回调函数
                 channel_->enableWriting(false);
                 if (write_complete_cb_) {
@@ -221,27 +254,47 @@ void TcpConnection::handleError() {
     LOGGER_ERROR("net", "Handle error from {}: {}", name_, std::strerror(err));
 }
 
-void TcpConnection::send_(const std::string& message) {
+void TcpConnection::send_(std::string_view message) {
+    size_t nwrote = 0;
+    if (prepareSend_(message, nwrote)) {
+        output_queue_.append(message.substr(nwrote));
+    }
+}
+
+void TcpConnection::sendString_(std::string& message) {
+    size_t nwrote = 0;
+    if (prepareSend_(message, nwrote)) {
+        output_queue_.append(std::move(message), nwrote);
+    }
+}
+
+void TcpConnection::sendShared_(std::string_view message, const std::shared_ptr<const void>& owner) {
+    size_t nwrote = 0;
+    if (prepareSend_(message, nwrote)) {
+        output_queue_.append(message.substr(nwrote), owner);
+    }
+}
+
+bool TcpConnection::prepareSend_(std::string_view message, size_t& nwrote) {
     loop_->checkIsInCreatorThread();
 
-    ssize_t nwrote    = 0;              // 已经写入的字节数目
-    size_t  remaining = message.size(); // 剩余的字节数目
-    bool    fault     = false;
+    size_t remaining = message.size(); // 剩余的字节数目
+    bool   fault     = false;
     if (state_ == State::Disconnected) {
         LOGGER_WARN("net", "Disconnected, give up writing");
-        return;
+        return false;
     }
 
-    // 如果输出缓冲区中没有数据 尝试直接发送数据
-    if (!channel_->isWriting() && !output_buffer_.isReadable()) {
-        nwrote = common::write(channel_->fd(), message.data(), message.size());
-        if (nwrote >= 0) { // 写入正确
+    // 如果输出队列中没有数据 尝试直接发送数据
+    if (!channel_->isWriting() && !output_queue_.isReadable()) {
+        ssize_t n = common::write(channel_->fd(), message.data(), message.size());
+        if (n >= 0) { // 写入正确
+            nwrote = static_cast<size_t>(n);
             remaining -= nwrote;
             if (remaining == 0 && write_complete_cb_) {
                 loop_->queueInLoop(std::bind(write_complete_cb_, shared_from_this()));
             }
         } else { // 写入错误
-            nwrote = 0;
             if (errno != EWOULDBLOCK) {
                 LOGGER_ERROR("net", "Failed to write data to peer {} from {}", peer_addr_.toIpPort(), name_);
                 // EPIPE 意味着与另一端的通信已经中断或对方已经关闭了连接
@@ -254,21 +307,22 @@ void TcpConnection::send_(const std::string& message) {
     }
 
     assert(remaining <= message.size());
-    // 如果没有发生EPIPE和ECONNRESET错误 且还有剩余数据未发送
-    if (!fault && remaining > 0) {
-        size_t old_len = output_buffer_.readableBytes();
-        // 如果缓冲区数据达到高水位标记则调用相应的回调函数
-        if (old_len + remaining >= high_water_mark_ && old_len < high_water_mark_ && high_water_mark_cb_) {
-            loop_->queueInLoop(std::bind(high_water_mark_cb_, shared_from_this(), old_len + remaining));
-        }
-        // 将剩余字节写入到输出缓冲区中
-        output_buffer_.writeBytes(std::string_view(message.data() + nwrote, remaining));
+    // 如果发生EPIPE和ECONNRESET错误 或者数据已经全部发送 则无需入队
+    if (fault || remaining == 0) {
+        return false;
+    }
 
-        // 让描述符关注可写事件
-        if (!channel_->isWriting()) {
-            channel_->enableWriting();
-        }
+    size_t old_len = output_queue_.readableBytes();
+    // 如果输出队列中的数据达到高水位标记则调用相应的回调函数
+    if (old_len + remaining >= high_water_mark_ && old_len < high_water_mark_ && high_water_mark_cb_) {
+        loop_->queueInLoop(std::bind(high_water_mark_cb_, shared_from_this(), old_len + remaining));
+    }
+
+    // 让描述符关注可写事件
+    if (!channel_->isWriting()) {
+        channel_->enableWriting();
     }
+    return true;
 }
 
 void TcpConnection::shutdown_() {
@@ -1,6 +1,7 @@
 #include <cassert>
 #include <log/log.h>
 #include <net/acceptor.h>
+#include <net/buffer_pool.h>
 #include <net/byte_buffer.h>
 #include <net/common.h>
 #include <net/event_loop.h>
@@ -56,6 +57,7 @@ void TcpServer::start() {
         }
 
         assert(!acceptor_->listening());
+        main_loop_->bufferPool()->setIdleTimeout(buffer_idle_timeout_);
         main_loop_->runInLoop(std::bind(&Acceptor::listen, acceptor_.get()));
     }
 }
@@ -80,6 +82,11 @@ void TcpServer::setWriteCompleteCallback(WriteCompleteCallback cb) {
     write_complete_cb_ = std::move(cb);
 }
 
+void TcpServer::setBufferIdleTimeout(Duration timeout) {
+    assert(!started_);
+    buffer_idle_timeout_ = timeout;
+}
+
 void TcpServer::newConnection(int sockfd, const InetAddress& peer_addr) {
     main_loop_->checkIsInCreatorThread();
 
@@ -120,6 +127,7 @@ void TcpServer::removeConnection_(const TcpConnectionPtr& conn) {
 
 void TcpServer::startSubEventLoop() {
     EventLoop sub_loop;
+    sub_loop.bufferPool()->setIdleTimeout(buffer_idle_timeout_);
 
     {
         std::lock_guard<std::mutex> lock(mtx_);
@@ -157,7 +157,7 @@ void RegistryCenter::requestSuccess(MessageType type, const net::TcpConnectionPt
         LOG_FATAL("Failed to serialize response data");
     }
     LOG_DEBUG("Send success response to the {}", conn->peerAddress().toIpPort());
-    conn->send(result);
+    conn->send(std::move(result));
 }
 
 void RegistryCenter::requestError(MessageType type, const net::TcpConnectionPtr& conn, const std::string& err_msg) {
@@ -173,7 +173,7 @@ void RegistryCenter::requestError(MessageType type, const net::TcpConnectionPtr&
         LOG_FATAL("Failed to serialize response data");
     }
     LOG_DEBUG("Send error response to the {}", conn->peerAddress().toIpPort());
-    conn->send(result);
+    conn->send(std::move(result));
 }
 
 void RegistryCenter::connectionAlive(const net::TcpConnectionPtr& conn) {
@@ -222,16 +222,18 @@ void RegistryCenter::broadcast(const std::string& service_name) {
     response.set_success(true);
     response.set_allocated_instance(instance);
 
-    std::string response_content;
-    if (!response.SerializeToString(&response_content)) {
+    // 所有连接共享同一份广播数据
+    auto response_content = std::make_shared<std::string>();
+    if (!response.SerializeToString(response_content.get())) {
         LOG_FATAL("Failed to serialize broadcast data");
     }
+    net::BufferPtr content = std::move(response_content);
 
     for (auto iter = conns_.begin(); iter != conns_.end(); ++iter) {
         auto& [name, alive] = iter->second;
         if (name != service_name) {
             LOG_DEBUG("Notify {} service named {} is dead", iter->first->peerAddress().toIpPort(), service_name);
-            iter->first->send(response_content);
+            iter->first->send(content);
         }
     }
 
@@ -144,7 +144,7 @@ void RpcProvider::sendRpcResponse(const net::TcpConnectionPtr& conn, MessagePtr
 
     std::string content;
     if (response->SerializeToString(&content)) {
-        conn->send(content);
+        conn->send(std::move(content));
     } else {
         LOGGER_ERROR("rpc", "Failed to serialize response");
     }
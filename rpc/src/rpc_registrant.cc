@@ -259,7 +259,7 @@ void RpcRegistrant::heartbeat(const net::TcpConnectionPtr& conn) {
     if (!request.SerializeToString(&res)) {
         LOGGER_FATAL("rpc", "Failed to serialize heartbeat data");
     }
-    conn->send(res);
+    conn->send(std::move(res));
 }
 
 void RpcRegistrant::enrollMethod_(const std::string& service_name, const std::string& method_name) {
@@ -283,7 +283,7 @@ void RpcRegistrant::enrollMethod_(const std::string& service_name, const std::st
         LOGGER_FATAL("rpc", "Failed to serialize enroll request");
     }
     LOGGER_TRACE("rpc", "Send enroll request to the RegistryCenter");
-    conn_->send(result);
+    conn_->send(std::move(result));
 }
 
 void RpcRegistrant::discoverMethod_(const std::string& service_name, const std::string& method_name) {
@@ -305,7 +305,7 @@ void RpcRegistrant::discoverMethod_(const std::string& service_name, const std::
         LOGGER_FATAL("rpc", "Failed to serialize discover request");
     }
     LOGGER_TRACE("rpc", "Send discover request to the RegistryCenter");
-    conn_->send(result);
+    conn_->send(std::move(result));
 }
 
 bool RpcRegistrant::isServiceExistInCache(const std::string& service_name, const std::string& method_name, net::InetAddress& provider_addr) {